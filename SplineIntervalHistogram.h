@@ -0,0 +1,42 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+
+class SplineParsedMaterial;
+
+/**
+ * Outputs the per-interval histogram of c collected by a SplineParsedMaterial
+ * with interval_histogram = true, summed over threads and processors. One row
+ * per spline interval plus a leading and a trailing row (with zero width at
+ * x_min and x_max) counting values below and above the spline domain. Counts
+ * accumulate over the whole run; write them with a CSV output to find where
+ * knots are needed and where the table can be coarsened.
+ */
+class SplineIntervalHistogram : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+  SplineIntervalHistogram(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  // 各线程的材料对象
+  std::vector<const SplineParsedMaterial *> _materials;
+
+  VectorPostprocessorValue & _x_left;
+  VectorPostprocessorValue & _x_right;
+  VectorPostprocessorValue & _count;
+};
@@ -0,0 +1,89 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "SplineTableAllocator.h"
+
+#include <array>
+#include <functional>
+#include <vector>
+
+/**
+ * Dense uniform resampling of a function and its first two derivatives.
+ * Each grid cell stores both end points interleaved in one 64 byte cache line,
+ * so a lookup is a single index computation plus a linear blend.
+ */
+class SplineLookupTable
+{
+public:
+  /// sampler(c, f, df/dc, d2f/dc2)
+  typedef std::function<void(Real, Real &, Real &, Real &)> Sampler;
+
+  SplineLookupTable() = default;
+
+  /// 是否为大表使用大页（需在build之前设置）
+  void setHugePages(bool huge_pages) { _huge_pages = huge_pages; }
+
+  /// 在调用线程中重新分配并复制查找表（NUMA first touch）
+  void relocate()
+  {
+    std::vector<Cell, SplineTableAllocator<Cell>>(_cells.begin(), _cells.end(), _cells.get_allocator())
+        .swap(_cells);
+  }
+
+  /**
+   * 在[x_min, x_max]上以n_points个均匀点重采样，并与sampler比较得到最大偏差
+   */
+  void build(Real x_min, Real x_max, unsigned int n_points, const Sampler & sampler);
+
+  /// 查表（c需已限制在定义域内）
+  void evaluate(Real c, Real & f, Real & df, Real & d2f) const
+  {
+    const Real t = (c - _x_min) * _inv_dx;
+    std::size_t i = t > 0.0 ? static_cast<std::size_t>(t) : 0;
+    if (i >= _cells.size())
+      i = _cells.size() - 1;
+    const Real w = t - i;
+    const Cell & cell = _cells[i];
+    f = cell.f0 + w * (cell.f1 - cell.f0);
+    df = cell.df0 + w * (cell.df1 - cell.df0);
+    d2f = cell.d2f0 + w * (cell.d2f1 - cell.d2f0);
+  }
+
+  bool empty() const { return _cells.empty(); }
+
+  /// 网格点数
+  std::size_t size() const { return _cells.empty() ? 0 : _cells.size() + 1; }
+
+  /// 相对于sampler的最大绝对偏差 {f, df/dc, d2f/dc2}
+  const std::array<Real, 3> & maxDeviation() const { return _max_deviation; }
+
+  /// 表占用的字节数
+  std::size_t memoryBytes() const { return _cells.capacity() * sizeof(Cell); }
+
+private:
+  /// 一个网格单元：左右两端点的 f, f_c, f_cc，补齐到一条缓存行
+  struct alignas(64) Cell
+  {
+    Real f0, df0, d2f0;
+    Real f1, df1, d2f1;
+    Real pad[2];
+  };
+
+  std::vector<Cell, SplineTableAllocator<Cell>> _cells;
+
+  bool _huge_pages = false;
+
+  Real _x_min = 0.0;
+  Real _inv_dx = 0.0;
+
+  std::array<Real, 3> _max_deviation = {{0.0, 0.0, 0.0}};
+};
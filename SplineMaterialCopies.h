@@ -0,0 +1,33 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseObject.h"
+
+#include <string>
+#include <vector>
+
+class FEProblemBase;
+class SplineParsedMaterial;
+
+/**
+ * Returns the per-thread block copies of the SplineParsedMaterial named by the
+ * 'material' parameter of object, reporting a paramError on 'material' when it
+ * is not a SplineParsedMaterial or when required_flag is given and that boolean
+ * parameter of the material is not set. With face_and_neighbor the face and
+ * neighbor copies MOOSE constructs on each thread are appended as well; they
+ * hold their own tables but do not accumulate the block quantities. Called from
+ * initialSetup of the postprocessors that read the material's per-copy state.
+ */
+std::vector<const SplineParsedMaterial *>
+splineMaterialCopies(const MooseObject & object,
+                     FEProblemBase & problem,
+                     const std::string & required_flag = "",
+                     bool face_and_neighbor = false);
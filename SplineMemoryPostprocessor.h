@@ -0,0 +1,57 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class SplineParsedMaterial;
+
+/**
+ * Reports the memory held by a SplineParsedMaterial: its tables, caches and
+ * histograms, the storage of its declared properties, or both, summed over
+ * the block, face and neighbor copies on every thread and either summed over
+ * or maximized across processes.
+ * Units and process reduction follow the MemoryUsage postprocessor so the two
+ * can be compared directly.
+ */
+class SplineMemoryPostprocessor : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+  SplineMemoryPostprocessor(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override { return _value; }
+
+protected:
+  /// 输出的量
+  enum class Quantity
+  {
+    TABLE_BYTES,
+    PROPERTY_BYTES,
+    TOTAL_BYTES
+  };
+
+  const Quantity _quantity;
+
+  // 进程间求和（total）或取最大（max_process）
+  const bool _max_process;
+
+  // 换算到mem_units的除数
+  Real _unit;
+
+  // 各线程的体积、面和相邻单元材料对象
+  std::vector<const SplineParsedMaterial *> _materials;
+
+  Real _value;
+};
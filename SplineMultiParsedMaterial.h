@@ -0,0 +1,73 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DerivativeMaterialInterface.h"
+#include "Material.h"
+#include "SplineQuadtree.h"
+#include "SplineSparseGrid.h"
+
+#include <memory>
+
+/**
+ * Free energy of several coupled variables, tabulated once from a parsed
+ * expression into an adaptive sparse-grid spline (or, for two variables, an
+ * adaptive quadtree) and evaluated from the table together with its gradient
+ * and Hessian.
+ */
+class SplineMultiParsedMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  static InputParameters validParams();
+  SplineMultiParsedMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  // 由表达式构建插值表
+  void buildInterpolant();
+
+  // 耦合变量
+  const unsigned int _n_vars;
+  std::vector<const VariableValue *> _vars;
+  std::vector<VariableName> _var_names;
+
+  // 定义域边界
+  std::vector<Real> _lower;
+  std::vector<Real> _upper;
+
+  // 属性名称与导数阶数
+  const std::string _property_name;
+  const unsigned int _derivative_order;
+
+  /// 插值表的类型
+  enum class Interpolant
+  {
+    SPARSE_GRID,
+    QUADTREE
+  };
+  const Interpolant _interpolant;
+
+  // 稀疏网格插值表（只读，由参数相同的线程副本及边界/界面副本共用）
+  std::shared_ptr<const SplineSparseGrid> _sparse_grid;
+
+  // 两个变量时的自适应四叉树表（interpolant = quadtree；同样由各副本共用）
+  std::shared_ptr<const SplineQuadtree> _quadtree;
+
+  // 材料属性：F，dF/dc_i，d2F/dc_i dc_j（只声明i <= j）
+  MaterialProperty<Real> & _f;
+  std::vector<MaterialProperty<Real> *> _dF;
+  std::vector<std::vector<MaterialProperty<Real> *>> _d2F;
+
+  // 求值的暂存数组
+  std::vector<Real> _x;
+  std::vector<Real> _grad;
+  std::vector<Real> _hessian;
+};
@@ -12,6 +12,18 @@
 #include "DerivativeMaterialInterface.h"
 #include "Material.h"
 #include "SplineInterpolation.h"
+#include "SplineLookupTable.h"
+#include "SplineQuantizedTable.h"
+#include "SplineSensitivity.h"
+#include "SplineTable.h"
+#include "SplineTableSet.h"
+#include "SplineTDBFreeEnergy.h"
+#include "SplineTiledTable.h"
+
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
 
 /**
  * Material that uses spline interpolation for free energy function
@@ -22,7 +34,48 @@ public:
   static InputParameters validParams();
   SplineParsedMaterial(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void residualSetup() override;
+  virtual void timestepSetup() override;
+  virtual void subdomainSetup() override;
+
+  /// f 及其导数对纵坐标 y_j 的灵敏度（compute_sensitivities = true 时可用）
+  const SplineSensitivity & sensitivity() const { return _sensitivity; }
+
+  /// 最近一次残差计算中累积的积分和统计量（本线程的单元）
+  struct Reductions
+  {
+    Real free_energy = 0.0;
+    Real volume = 0.0;
+    Real spinodal_volume = 0.0;
+    Real min_f_cc = std::numeric_limits<Real>::max();
+    Real max_f_cc = std::numeric_limits<Real>::lowest();
+    unsigned long out_of_domain = 0;
+  };
+
+  /// compute_reductions = true 时可用
+  const Reductions & reductions() const { return _reductions; }
+
+  /// 直方图的区间端点（interval_histogram = true 时可用）
+  const std::vector<Real> & histogramKnots() const { return _histogram_knots; }
+
+  /// 本线程的计数：第0个和最后一个为定义域外，第i个为区间[x_{i-1}, x_i)
+  const std::vector<unsigned long> & intervalCounts() const { return _interval_counts; }
+
+  /// 本线程在computeProperties中累计的时间 [s]（collect_timing = true 时可用）
+  Real evaluationTime() const { return _evaluation_time; }
+
+  /// 计时期间求值的积分点数
+  unsigned long timedPoints() const { return _timed_points; }
+
+  /// 本对象持有的样条数据（各种表、节点缓存、直方图）的字节数
+  std::size_t tableBytes() const;
+
+  /// 本对象声明的材料属性在一个单元的积分点上占用的字节数
+  std::size_t propertyBytes() const;
+
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   // 使用样条计算函数值
@@ -31,6 +84,100 @@ protected:
   // 使用样条计算导数
   virtual Real computeDerivative(Real c, unsigned int order) const;
 
+  // 将c限制在定义域内（首次越界时警告）
+  Real clampToDomain(Real c) const { return clampToDomain(c, _x_min, _x_max); }
+  Real clampToDomain(Real c, Real x_min, Real x_max) const;
+
+  // 当前子域所用的表编号（子域不在表中时报错）
+  unsigned int subdomainTable() const;
+
+  // 用表集合中的第t张表计算并写入当前积分点的属性
+  void computeQpTableSetProperties(unsigned int t);
+
+  /// 求值后端
+  enum class EvaluationBackend
+  {
+    BINARY,
+    UNIFORM,
+    LUT,
+    UNROLLED,
+    TILED,
+    QUANTIZED
+  };
+
+  // 用指定后端计算 f, df/dc, d2f/dc2（c需已限制在定义域内）
+  void evaluate(EvaluationBackend backend, Real c, Real & f, Real & df, Real & d2f) const
+  {
+    switch (backend)
+    {
+      case EvaluationBackend::LUT:
+        _lookup_table.evaluate(c, f, df, d2f);
+        return;
+      case EvaluationBackend::UNIFORM:
+      case EvaluationBackend::UNROLLED:
+        _table.evaluate(c, f, df, d2f);
+        return;
+      case EvaluationBackend::TILED:
+        _tiled_table.evaluate(c, f, df, d2f);
+        return;
+      case EvaluationBackend::QUANTIZED:
+        _quantized_table.evaluate(c, f, df, d2f);
+        return;
+      default:
+        f = _spline.sample(c);
+        df = _spline.sampleDerivative(c);
+        d2f = _spline.sample2ndDerivative(c);
+    }
+  }
+
+  // 启动时微基准测试，选出最快的后端
+  void autotuneBackend();
+
+  // 检查表相关参数、选择后端并声明附加属性（在构造函数中同步进行）
+  void checkTables();
+
+  // 读入或拟合全部样条表（可在后台线程中进行）
+  void loadTables();
+
+  // 从0号线程的体积材料复制后台制表的结果（asynchronous_setup）
+  void shareTables();
+
+  // 由x/y拟合样条及各种派生表
+  void fitTables();
+
+  // 打印样条信息
+  void reportTables() const;
+
+  // 由CALPHAD数据库自适应制表（或读入缓存）得到x/y
+  void tabulateDatabase();
+
+  // 不再计算没有消费者的导数属性（仍已声明，改为写零）
+  void skipUnrequestedDerivatives();
+
+  // 把跳过的导数属性在当前单元的积分点上置零
+  void zeroSkippedDerivatives();
+
+  // 按当前时间混合各时刻的系数（blend_times）
+  void blendTables();
+
+  // 把样条表压缩到已观测到的节点窗口
+  void compactTableWindow();
+
+  // 在节点上求值并插值到积分点（nodal_evaluation，只用于体积积分点）
+  void computeNodalProperties();
+
+  // 累积当前单元的积分和统计量
+  void accumulateReductions();
+
+  // 把当前单元的c计入区间直方图
+  void recordIntervals();
+
+  // 在降阶的浓度采样点上求值并插值到全部积分点；精度检查失败时返回false
+  bool computeReducedProperties();
+
+  // 窗口内用压缩表求值，窗口外退回完整表
+  void evaluateWindowed(Real c, Real & f, Real & df, Real & d2f);
+
 private:
   // 样条插值对象
   SplineInterpolation _spline;
@@ -61,4 +208,130 @@ private:
   // 定义域边界
   Real _x_min;
   Real _x_max;
+
+  // 稠密均匀查找表（lookup_table_points > 0 时启用）
+  SplineLookupTable _lookup_table;
+
+  // 分段多项式系数表（uniform/unrolled后端）
+  SplineTable _table;
+
+  // 量化存储的系数表（coefficient_storage = int32/int16）
+  SplineQuantizedTable _quantized_table;
+
+  // 分块、内存映射的表文件（table_file）
+  SplineTiledTable _tiled_table;
+
+  // 进程本地的表窗口（table_window）
+  const bool _table_window;
+  const unsigned int _table_window_margin;
+  SplineTable _window;
+  bool _windowed;
+  Real _window_min;
+  Real _window_max;
+  Real _observed_min;
+  Real _observed_max;
+  unsigned long _window_fallbacks;
+
+  // 当前使用的求值后端
+  EvaluationBackend _backend;
+
+  // evaluation_backend = auto
+  const bool _autotune;
+
+  // 是否在求值线程中重新分配样条表（NUMA first touch）
+  const bool _numa_replicate;
+
+  // 本线程是否已完成重新分配
+  bool _replicated;
+
+  // 集合样条：共享节点的K组系数（y_ensemble）
+  SplineTable _ensemble;
+
+  // 集合成员的材料属性及其导数
+  std::vector<MaterialProperty<Real> *> _ensemble_f;
+  std::vector<MaterialProperty<Real> *> _ensemble_dF_dc;
+  std::vector<MaterialProperty<Real> *> _ensemble_d2F_dc2;
+
+  // 集合求值的暂存数组
+  std::vector<Real> _ensemble_f_val;
+  std::vector<Real> _ensemble_df_val;
+  std::vector<Real> _ensemble_d2f_val;
+
+  // 对纵坐标y的灵敏度（稀疏：非零的y下标及三组对应的值）
+  SplineSensitivity _sensitivity;
+  MaterialProperty<std::vector<unsigned int>> * _dF_dy_indices;
+  MaterialProperty<std::vector<Real>> * _dF_dy;
+  MaterialProperty<std::vector<Real>> * _d2F_dcdy;
+  MaterialProperty<std::vector<Real>> * _d3F_dc2dy;
+  std::vector<Real> _sensitivity_scratch;
+
+  // 多张表的集合：第0张为x/y，其余来自table_x/table_y
+  SplineTableSet _table_set;
+
+  // 子域ID -> 表编号
+  std::vector<unsigned int> _subdomain_table;
+
+  // 选择表的编号变量（晶粒或相编号）
+  const VariableValue * _table_index;
+
+  // 由数据库制得的表（tdb_file），进程内各副本共用一次制表的结果
+  std::shared_ptr<const SplineTDBFreeEnergy::Table> _database_table;
+
+  // 后台读入和拟合（asynchronous_setup）
+  std::future<void> _setup_future;
+
+  // 节点求值（nodal_evaluation）
+  const bool _nodal_evaluation;
+  const MooseVariable & _c_var;
+  const VariableValue & _c_dofs;
+
+  /// 一个节点上的c及 f, f_c, f_cc
+  struct NodalValues
+  {
+    Real c = std::numeric_limits<Real>::quiet_NaN();
+    Real f = 0.0;
+    Real df = 0.0;
+    Real d2f = 0.0;
+  };
+
+  // 节点ID -> 上次求值的结果；c不变时直接复用
+  std::unordered_map<dof_id_type, NodalValues> _nodal_cache;
+
+  // 当前单元各节点的值
+  std::vector<NodalValues> _element_nodal_values;
+
+  // 降阶求值（reduced_points）
+  static constexpr unsigned int max_reduced_points = 6;
+  const unsigned int _reduced_points;
+  const Real _reduced_tolerance;
+  unsigned long _reduced_elements;
+  unsigned long _reduced_fallbacks;
+
+  // 求值时顺带累积的积分和统计量（compute_reductions）
+  const bool _compute_reductions;
+  Reductions _reductions;
+
+  // 各样条区间的浓度直方图（interval_histogram）
+  const bool _interval_histogram;
+  const unsigned int _histogram_stride;
+  unsigned int _histogram_skip;
+  std::vector<Real> _histogram_knots;
+  std::vector<unsigned long> _interval_counts;
+
+  // 随时间混合的多张表（blend_times）：各时刻的表作为共享节点的多组系数
+  std::vector<Real> _blend_times;
+  SplineTable _blend_stages;
+  Real _blended_time;
+
+  // 扩展性测试用的计时（collect_timing）
+  const bool _collect_timing;
+  Real _evaluation_time;
+  unsigned long _timed_points;
+
+  // 没有消费者、不再计算的导数属性：已声明的存储每个单元写零，不留未初始化的值
+  std::vector<MaterialProperty<Real> *> _skipped_derivatives;
+  std::vector<MaterialProperty<std::vector<Real>> *> _skipped_sensitivities;
+
+  // 本线程是否已给出越界警告
+  mutable bool _domain_warned;
 };
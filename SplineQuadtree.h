@@ -0,0 +1,164 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Adaptive two-dimensional table of f(x, y) on a rectangle. The rectangle is
+ * split as a quadtree, refining only the cells where a bicubic Hermite patch
+ * through the corner values and derivatives misses the generator by more than
+ * the tolerance, so resolution gathers around wells, gaps and other features.
+ * The tree is 2:1 balanced (edge neighbours differ by at most one level) and
+ * the hanging nodes on the edge of a coarser leaf take the value and
+ * derivatives of that leaf's patch there, so the table is C1 everywhere.
+ * Corner data is stored once per node and shared by the neighbouring leaves.
+ * Leaves are kept in Morton (Z-curve) order: a point is located by
+ * interleaving the bits of its finest-level cell index and binary searching
+ * the leaves' start codes.
+ */
+class SplineQuadtree
+{
+public:
+  /// 生成函数：自变量数组（长度为2） -> 函数值
+  typedef std::function<Real(const Real *)> Generator;
+
+  /// 最大细化层级（Morton码为64位）
+  static constexpr unsigned int max_level_limit = 30;
+
+  SplineQuadtree() = default;
+
+  /**
+   * 自适应构建：从min_level的均匀划分开始，每次细分误差最大的叶子单元，直到误差不超过
+   * tolerance、节点数达到max_points，或叶子层级达到max_level。之后做2:1平衡（可能超出
+   * max_points），并把悬挂节点约束到粗叶子的插值上
+   */
+  void build(const std::vector<Real> & lower,
+             const std::vector<Real> & upper,
+             const Generator & generator,
+             Real tolerance,
+             std::size_t max_points,
+             unsigned int max_level,
+             unsigned int min_level = 2);
+
+  /**
+   * 计算函数值；grad（长度2）与hessian（2*2，按行存放）为nullptr时不计算。
+   * x需已限制在定义域内。
+   */
+  void evaluate(const Real * x, Real & f, Real * grad, Real * hessian) const;
+
+  /// 节点数（每个节点存放函数值及导数）
+  std::size_t numPoints() const { return _num_points; }
+
+  /// 叶子单元数
+  std::size_t numLeaves() const { return _leaves.size(); }
+
+  /// 叶子达到的最高层级
+  unsigned int maxLevel() const { return _depth; }
+
+  /// 约束悬挂节点后，叶子单元检查点上的最大插值误差
+  Real errorEstimate() const { return _error_estimate; }
+
+  /// 被约束到粗叶子插值上的悬挂节点数
+  std::size_t numHangingNodes() const { return _num_hanging; }
+
+  /// 存储占用的字节数
+  std::size_t memoryBytes() const;
+
+protected:
+  /// 一个节点上的函数值及导数
+  struct Node
+  {
+    Real f;
+    Real fx;
+    Real fy;
+    Real fxy;
+  };
+
+  /// 一个叶子单元：四个角点（按 (0,0), (1,0), (0,1), (1,1) 的顺序）的节点编号及层级
+  struct Leaf
+  {
+    std::array<std::uint32_t, 4> corner;
+    unsigned int level;
+  };
+
+  /// 节点（采样分辨率的整数坐标）上的数据，用差分求导
+  const Node & node(std::uint32_t i, std::uint32_t j, const Generator & generator);
+
+  /// 采样分辨率的整数坐标处的函数值（缓存）
+  Real sample(std::uint32_t i, std::uint32_t j, const Generator & generator);
+
+  /**
+   * 层级level的单元上，由四个角点数据构成的双三次Hermite插值在局部坐标(u, v)处的值；
+   * grad与hessian为对物理坐标的导数，为nullptr时不计算
+   */
+  void hermite(const Node * const * corner,
+               unsigned int level,
+               Real u,
+               Real v,
+               Real & f,
+               Real * grad,
+               Real * hessian) const;
+
+  /// 单元中心和四条边中点上的插值误差（均为细分后的节点）
+  Real cellError(unsigned int level, std::uint32_t i, std::uint32_t j, const Generator & generator);
+
+  /// 给定角点数据时，起点为采样坐标(i0, j0)的单元在上述检查点上的插值误差
+  Real patchError(const Node * const * corner,
+                  unsigned int level,
+                  std::uint32_t i0,
+                  std::uint32_t j0,
+                  const Generator & generator);
+
+  /**
+   * 2:1平衡：细分与更细两级的单元相邻的叶子，直到相邻叶子的层级至多相差1。
+   * split记录各层级已细分的单元，add_cell新建单元并返回其编号
+   */
+  template <typename Cell, typename AddCell>
+  void balance(std::vector<Cell> & cells,
+               std::vector<std::size_t> & leaves,
+               std::vector<std::unordered_set<std::uint64_t>> & split,
+               const AddCell & add_cell);
+
+  /// 把落在粗叶子边上的节点的值及导数设为该叶子插值在此处的值，使插值C1连续
+  void constrainHangingNodes(const std::vector<std::uint64_t> & node_keys);
+
+  /// 包含最细层级单元(i, j)的叶子编号
+  std::size_t leafIndex(std::uint32_t i, std::uint32_t j) const;
+
+  std::array<Real, 2> _lower;
+  std::array<Real, 2> _upper;
+
+  /// 最细层级（整数坐标的分辨率为2^_max_level）
+  unsigned int _max_level = 0;
+
+  /// 按Morton码排序的叶子单元及其起始码
+  std::vector<std::uint64_t> _codes;
+  std::vector<Leaf> _leaves;
+
+  /// 叶子角点上的节点数据（相邻叶子共享）
+  std::vector<Node> _node_data;
+
+  /// 构建时缓存的节点数据与采样值
+  std::unordered_map<std::uint64_t, Node> _nodes;
+  std::unordered_map<std::uint64_t, Real> _samples;
+
+  std::size_t _num_points = 0;
+  unsigned int _depth = 0;
+  Real _error_estimate = 0.0;
+  std::size_t _num_hanging = 0;
+};
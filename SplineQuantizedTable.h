@@ -0,0 +1,136 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "SplineTableAllocator.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class SplineTable;
+
+/**
+ * A SplineTable stored as 16 or 32 bit integer codes of the knot values and
+ * first derivatives. Knots are grouped into blocks; each block stores an offset
+ * and a scale for the values and for the derivatives. During evaluation the two
+ * knots of an interval are decoded in registers and the cubic Hermite
+ * coefficients rebuilt from them, so neighbouring intervals share the decoded
+ * knot data and f and df/dc stay continuous at the knots; only d2f/dc2 jumps.
+ * The worst case error of f and its first two derivatives and the largest
+ * d2f/dc2 jump introduced by the quantization are bounded at build time.
+ */
+class SplineQuantizedTable
+{
+public:
+  SplineQuantizedTable() = default;
+
+  /// 是否为大表使用大页（需在build之前设置）
+  void setHugePages(bool huge_pages) { _huge_pages = huge_pages; }
+
+  /// 在调用线程中重新分配并复制（NUMA first touch）
+  void relocate();
+
+  /**
+   * 将单组系数的table在节点上的值和一阶导数量化为bits（16或32）位整数，
+   * 每block_intervals个节点共用偏移和比例
+   */
+  void build(const SplineTable & table, unsigned int bits, unsigned int block_intervals = 64);
+
+  bool empty() const { return _x.empty(); }
+
+  /// 计算函数值及一、二阶导数（c需已限制在定义域内）
+  void evaluate(Real c, Real & f, Real & df, Real & d2f) const
+  {
+    const std::size_t i = interval(c);
+    Real k[4];
+    if (_bits == 16)
+      decode(_codes16.data(), i, k);
+    else
+      decode(_codes32.data(), i, k);
+    Real a[4];
+    hermite(k, _x[i + 1] - _x[i], a);
+    const Real t = c - _x[i];
+    f = a[0] + t * (a[1] + t * (a[2] + t * a[3]));
+    df = a[1] + t * (2.0 * a[2] + 3.0 * t * a[3]);
+    d2f = 2.0 * a[2] + 6.0 * t * a[3];
+  }
+
+  /// 量化引入的最大误差上界 {f, df/dc, d2f/dc2}
+  const std::array<Real, 3> & errorBound() const { return _error_bound; }
+
+  /// 节点处d2f/dc2左右极限之差的最大值（f与df/dc在节点处连续）
+  Real secondDerivativeJump() const { return _second_derivative_jump; }
+
+  /// 每个系数的位数
+  unsigned int bits() const { return _bits; }
+
+  /// 占用的字节数
+  std::size_t memoryBytes() const;
+
+protected:
+  /// 最后一个 x_i <= c 的区间（等距时直接计算）
+  std::size_t interval(Real c) const
+  {
+    if (_uniform)
+    {
+      const Real t = (c - _x.front()) * _inv_h;
+      const std::size_t i = t > 0.0 ? static_cast<std::size_t>(t) : 0;
+      return std::min(i, _x.size() - 2);
+    }
+    return std::upper_bound(_x.begin() + 1, _x.end() - 1, c) - _x.begin() - 1;
+  }
+
+  /// 在寄存器中解码第i个区间两端节点的 {f_i, f'_i, f_{i+1}, f'_{i+1}}
+  template <typename Code>
+  void decode(const Code * codes, std::size_t i, Real * k) const
+  {
+    for (unsigned int j = 0; j < 2; ++j)
+    {
+      const Real * block = _block.data() + 4 * ((i + j) >> _block_shift);
+      const Code * code = codes + 2 * (i + j);
+      k[2 * j] = block[0] + block[2] * code[0];
+      k[2 * j + 1] = block[1] + block[3] * code[1];
+    }
+  }
+
+  /// 由两端节点的值和一阶导数构造区间上的三次Hermite多项式系数（t = c - x_i）
+  static void hermite(const Real * k, Real h, Real * a)
+  {
+    const Real inv_h = 1.0 / h;
+    const Real slope = (k[2] - k[0]) * inv_h;
+    a[0] = k[0];
+    a[1] = k[1];
+    a[2] = (3.0 * slope - 2.0 * k[1] - k[3]) * inv_h;
+    a[3] = (k[1] + k[3] - 2.0 * slope) * inv_h * inv_h;
+  }
+
+  std::vector<Real, SplineTableAllocator<Real>> _x;
+
+  /// 每块：函数值与一阶导数的偏移，随后二者的比例
+  std::vector<Real, SplineTableAllocator<Real>> _block;
+
+  /// 每个节点两个码：函数值与一阶导数
+  std::vector<std::int16_t, SplineTableAllocator<std::int16_t>> _codes16;
+  std::vector<std::int32_t, SplineTableAllocator<std::int32_t>> _codes32;
+
+  unsigned int _bits = 0;
+  unsigned int _block_shift = 0;
+
+  bool _uniform = false;
+  Real _inv_h = 0.0;
+
+  bool _huge_pages = false;
+
+  std::array<Real, 3> _error_bound = {{0.0, 0.0, 0.0}};
+  Real _second_derivative_jump = 0.0;
+};
@@ -0,0 +1,58 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class SplineParsedMaterial;
+
+/**
+ * Reports one of the quantities a SplineParsedMaterial with
+ * compute_reductions = true accumulated during the last residual evaluation:
+ * the free energy integral, the range of f_cc, the spinodal volume (fraction)
+ * or the number of out-of-domain quadrature points. The per-thread material
+ * copies are combined here and across processors in finalize(), so no extra
+ * pass over the mesh is made.
+ */
+class SplineReductionPostprocessor : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+  SplineReductionPostprocessor(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override { return _value; }
+
+protected:
+  /// 输出的量
+  enum class Quantity
+  {
+    FREE_ENERGY,
+    MIN_F_CC,
+    MAX_F_CC,
+    SPINODAL_VOLUME,
+    SPINODAL_FRACTION,
+    VOLUME,
+    OUT_OF_DOMAIN
+  };
+
+  const Quantity _quantity;
+
+  // 各线程的材料对象
+  std::vector<const SplineParsedMaterial *> _materials;
+
+  Real _value;
+
+  // spinodal_fraction 的分母
+  Real _volume;
+};
@@ -0,0 +1,76 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <vector>
+
+/**
+ * Sensitivities of a cubic spline and its first two derivatives with respect to
+ * the tabulated ordinates y_j. The knot second derivatives depend linearly on y
+ * through the inverse of the tridiagonal spline system, which only depends on
+ * the knots and the boundary condition types. Its columns are obtained once by
+ * solving the tridiagonal system for each unit y_j and stored row-compressed;
+ * the entries decay geometrically away from the diagonal and can be truncated,
+ * so that f and its derivatives depend on only a few y_j at any c.
+ */
+class SplineSensitivity
+{
+public:
+  SplineSensitivity() = default;
+
+  /**
+   * @param x 节点
+   * @param clamped_left/right 边界是否给定一阶导数（否则为自然边界）
+   * @param tolerance 相对同一y_j的最大灵敏度小于此值的元素被舍去（0为保留全部非零元）
+   */
+  void build(const std::vector<Real> & x, bool clamped_left, bool clamped_right, Real tolerance);
+
+  bool empty() const { return _x.empty(); }
+
+  /// 纵坐标个数
+  std::size_t size() const { return _x.size(); }
+
+  /**
+   * 计算c处 f、df/dc、d2f/dc2 对各 y_j 的稀疏灵敏度：
+   * indices中的每个j对应 df[k]、ddf_dc[k]、dd2f_dc2[k]
+   */
+  void evaluate(Real c,
+                std::vector<unsigned int> & indices,
+                std::vector<Real> & df,
+                std::vector<Real> & ddf_dc,
+                std::vector<Real> & dd2f_dc2) const;
+
+  /// 存储的逆矩阵非零元个数
+  std::size_t numNonzeros() const { return _val.size(); }
+
+  /// evaluate在任一c处返回的灵敏度个数的上界
+  std::size_t maxEntries() const { return _max_entries; }
+
+  /// 占用的字节数
+  std::size_t memoryBytes() const;
+
+private:
+  /// 最后一个 x_i <= c 的区间
+  unsigned int interval(Real c) const;
+
+  /// 逆矩阵元素 d y2_i / d y_j（未存储时为0）
+  Real entry(unsigned int i, unsigned int j) const;
+
+  std::vector<Real> _x;
+
+  /// d y2_i / d y_j，按行压缩存储
+  std::vector<std::size_t> _row_start;
+  std::vector<unsigned int> _col;
+  std::vector<Real> _val;
+
+  std::size_t _max_entries = 0;
+};
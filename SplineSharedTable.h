@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/// 进程内所有共享表缓存共用的锁
+inline std::mutex &
+sharedTableMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/**
+ * Returns the read-only table cached under key, building it with build while
+ * holding the lock if it is missing or has been released by every copy. Used
+ * to build a table once per process and share it between the per-thread,
+ * boundary and interface copies of a material; key must capture every input
+ * that determines the table. A build that throws leaves no entry behind.
+ */
+template <typename Table, typename Build>
+std::shared_ptr<const Table>
+sharedTable(std::map<std::string, std::weak_ptr<const Table>> & cache,
+            const std::string & key,
+            const Build & build)
+{
+  std::lock_guard<std::mutex> lock(sharedTableMutex());
+  auto & entry = cache[key];
+  auto table = entry.lock();
+  if (!table)
+  {
+    auto built = std::make_shared<Table>();
+    build(*built);
+    table = built;
+    entry = table;
+  }
+  return table;
+}
@@ -0,0 +1,121 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <array>
+#include <functional>
+#include <map>
+#include <vector>
+
+/**
+ * Sparse-grid interpolant of a function of d variables on a box, built with the
+ * dimension-adaptive combination technique. The interpolant is a signed sum of
+ * small anisotropic tensor-product grids with 2^l_k + 1 points in direction k;
+ * each grid is a natural cubic spline in B-spline form, so values, gradients
+ * and Hessians are smooth and cheap. Grids are added greedily where the current
+ * interpolant deviates most from the generator, so the point count grows far
+ * slower than the N^d of a full tensor-product table.
+ */
+class SplineSparseGrid
+{
+public:
+  /// 支持的最大维数
+  static constexpr unsigned int max_dimension = 8;
+
+  /// 生成函数：自变量数组（长度为维数） -> 函数值
+  typedef std::function<Real(const Real *)> Generator;
+
+  SplineSparseGrid() = default;
+
+  /**
+   * 自适应构建：每次加入对当前插值误差最大的分量网格，直到误差不超过tolerance、
+   * 生成函数的求值点数达到max_points，或各方向层级达到max_level
+   */
+  void build(const std::vector<Real> & lower,
+             const std::vector<Real> & upper,
+             const Generator & generator,
+             Real tolerance,
+             std::size_t max_points,
+             unsigned int max_level);
+
+  /**
+   * 计算函数值；grad（长度d）与hessian（d*d，按行存放）为nullptr时不计算。
+   * x需已限制在定义域内。
+   */
+  void evaluate(const Real * x, Real & f, Real * grad, Real * hessian) const;
+
+  unsigned int dimension() const { return _lower.size(); }
+
+  /// 生成函数的求值点数（稀疏网格的点数）
+  std::size_t numPoints() const { return _num_points; }
+
+  /// 参与组合的分量网格数
+  std::size_t numGrids() const { return _grids.size(); }
+
+  /// 各方向达到的最高层级
+  const std::vector<unsigned int> & maxLevels() const { return _max_levels; }
+
+  /// 构建结束时剩余候选网格上的最大插值误差
+  Real errorEstimate() const { return _error_estimate; }
+
+  /// 存储占用的字节数
+  std::size_t memoryBytes() const;
+
+protected:
+  /// 一个分量网格：B样条控制点（每个方向两侧各补一个）及组合系数
+  struct Grid
+  {
+    std::vector<unsigned int> level;
+    std::vector<unsigned int> intervals;
+    std::vector<std::size_t> stride;
+    std::vector<Real> control;
+    Real coefficient = 0.0;
+  };
+
+  /// 函数值及各方向的一、二阶导数（Hessian只存上三角）
+  struct Jet
+  {
+    Real value;
+    std::array<Real, max_dimension> grad;
+    std::array<Real, max_dimension * max_dimension> hessian;
+  };
+
+  /// 在网格节点上采样生成函数并求出控制点
+  void fitGrid(Grid & grid, const Generator & generator);
+
+  /// 计算单个网格的函数值及（derivatives为true时）导数
+  void evaluateGrid(const Grid & grid, const Real * x, bool derivatives, Jet & jet) const;
+
+  /// 在第k个方向上收缩控制点（递归）
+  void contract(const Grid & grid,
+                unsigned int k,
+                std::size_t offset,
+                const std::array<std::array<Real, 4>, max_dimension> * weights,
+                const std::array<unsigned int, max_dimension> & cell,
+                bool derivatives,
+                Jet & jet) const;
+
+  std::vector<Real> _lower;
+  std::vector<Real> _upper;
+
+  /// 参与组合（系数非零）的网格
+  std::vector<Grid> _grids;
+
+  /// 按最高层级二进坐标缓存的生成函数值（仅在构建时使用）
+  std::map<std::vector<unsigned long>, Real> _samples;
+  unsigned int _key_level = 0;
+
+  std::size_t _num_points = 0;
+  std::vector<unsigned int> _max_levels;
+  Real _error_estimate = 0.0;
+
+};
@@ -0,0 +1,123 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Molar Gibbs energy of a binary substitutional phase read from a CALPHAD TDB
+ * database. A subset of the format is understood: FUNCTION, PHASE, CONSTITUENT
+ * and G/L PARAMETER commands with piecewise temperature ranges. The phase must
+ * mix the two components on one sublattice with only vacancies on the others;
+ * its Gibbs energy per mole of atoms at the given temperature is
+ *
+ *   G = (1-c) G_A + c G_B + RT (c ln c + (1-c) ln(1-c)) + c (1-c) sum_n L_n (1-2c)^n
+ *
+ * with c the mole fraction of the second component. The endmember and
+ * interaction parameters are evaluated once at construction.
+ */
+class SplineTDBFreeEnergy
+{
+public:
+  /**
+   * @param components 两个组元，c为第二个组元的摩尔分数
+   * @param temperature 温度 [K]
+   */
+  SplineTDBFreeEnergy(const std::string & file_name,
+                      const std::string & phase,
+                      const std::vector<std::string> & components,
+                      Real temperature);
+
+  /// 制得的表：节点及其上的Gibbs能
+  struct Table
+  {
+    std::vector<Real> x;
+    std::vector<Real> y;
+  };
+
+  /// 每摩尔原子的Gibbs能及其对c的一、二阶导数
+  void evaluate(Real c, Real & g, Real & dg, Real & d2g) const;
+
+  /**
+   * 在[c_min, c_max]上自适应制表：逐步加密节点，直到样条在每个区间
+   * 1/4、1/2、3/4处与G的偏差都不超过tolerance
+   */
+  void tabulate(Real c_min,
+                Real c_max,
+                Real tolerance,
+                std::vector<Real> & x,
+                std::vector<Real> & y) const;
+
+  /// 标识数据库内容、相、组元、温度及制表参数的缓存键
+  std::string cacheKey(Real c_min, Real c_max, Real tolerance) const;
+
+  /// 读入缓存的表；文件不存在或键不匹配时返回false
+  static bool
+  readCache(const std::string & file_name, const std::string & key, std::vector<Real> & x, std::vector<Real> & y);
+
+  /// 写出缓存的表
+  static void writeCache(const std::string & file_name,
+                         const std::string & key,
+                         const std::vector<Real> & x,
+                         const std::vector<Real> & y);
+
+  /// 第n阶相互作用参数 L_n [J/mol]
+  const std::vector<Real> & interactionParameters() const { return _L; }
+
+protected:
+  /// 分段的温度表达式：第k段在[t_bounds[k], t_bounds[k+1])上有效
+  struct PiecewiseExpression
+  {
+    std::vector<Real> t_bounds;
+    std::vector<std::string> expressions;
+  };
+
+  /// 解析数据库中的命令
+  void parse(const std::string & text);
+
+  /// 读入温度分段："Tlow expr; Thigh Y expr; ... Tmax N"
+  static PiecewiseExpression parseRanges(const std::string & text, const std::string & context);
+
+  /// 在_temperature处计算分段表达式
+  Real evaluateExpression(const PiecewiseExpression & expression, const std::string & context);
+
+  /// 在_temperature处计算FUNCTION（带记忆）
+  Real evaluateFunction(const std::string & name);
+
+  const std::string _file_name;
+  const std::string _phase;
+  const std::vector<std::string> _components;
+  const Real _temperature;
+
+  /// 数据库原文（用于缓存键）
+  std::string _contents;
+
+  std::map<std::string, PiecewiseExpression> _functions;
+  std::map<std::string, Real> _function_values;
+  std::set<std::string> _functions_in_progress;
+
+  /// 相的亚点阵位置比和各亚点阵的组元
+  std::vector<Real> _site_ratios;
+  std::vector<std::vector<std::string>> _constituents;
+
+  /// 所选相的参数：端元（按组元）与相互作用（按阶数，已换算为A,B顺序）
+  std::map<unsigned int, PiecewiseExpression> _endmember_expressions;
+  std::map<unsigned int, PiecewiseExpression> _interaction_expressions;
+
+  /// 端元Gibbs能、相互作用参数（每摩尔式量）及混合亚点阵的位置数
+  Real _G[2];
+  std::vector<Real> _L;
+  Real _sites;
+};
@@ -0,0 +1,255 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "SplineTableAllocator.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * Cubic spline stored as per-interval polynomial coefficients. Produces the same
+ * interpolant as SplineInterpolation, but evaluates f, df/dc and d2f/dc2 with a
+ * single interval search and offers several search strategies. Several
+ * coefficient sets can share one knot grid; they are interleaved so that all
+ * sets are evaluated in one vectorizable sweep after a single search.
+ */
+class SplineTable
+{
+public:
+  /// 区间查找方式
+  enum class Search
+  {
+    BINARY,
+    UNIFORM,
+    UNROLLED
+  };
+
+  typedef std::vector<Real, SplineTableAllocator<Real>> Storage;
+
+  SplineTable() = default;
+
+  /// 是否为大表使用大页（需在setData之前设置）
+  void setHugePages(bool huge_pages) { _huge_pages = huge_pages; }
+
+  /**
+   * 在调用线程中重新分配并复制全部存储。由求值线程调用时，
+   * 首次访问（first touch）策略会把表放到该线程所在的NUMA节点上。
+   */
+  void relocate();
+
+  /**
+   * 设置样条数据，yp1/ypn >= 1e30 表示自然边界条件
+   */
+  void setData(const std::vector<Real> & x,
+               const std::vector<Real> & y,
+               Real yp1 = 1e30,
+               Real ypn = 1e30);
+
+  /**
+   * 设置共享同一组节点的多组纵坐标，每组一条样条
+   */
+  void setData(const std::vector<Real> & x,
+               const std::vector<std::vector<Real>> & ys,
+               Real yp1 = 1e30,
+               Real ypn = 1e30);
+
+  /**
+   * 设置周期样条：周期为 x.back() - x.front()，要求 y.front() == y.back()，
+   * 在两端值、一阶和二阶导数都连续。求值前用wrap()把自变量折回一个周期内。
+   */
+  void setPeriodicData(const std::vector<Real> & x, const std::vector<Real> & y);
+
+  /**
+   * 直接由节点和分段多项式系数（布局同_coef）设置表
+   */
+  void setCoefficients(const std::vector<Real> & x,
+                       const std::vector<Real> & coef,
+                       unsigned int n_sets = 1);
+
+  /**
+   * 取出区间[first, last]的节点和系数，可用setCoefficients构造只覆盖该窗口的表
+   */
+  void extract(unsigned int first,
+               unsigned int last,
+               std::vector<Real> & x,
+               std::vector<Real> & coef) const;
+
+  /**
+   * 节点相同时，用多组表stages中第k组与第k+1组系数的线性组合 (1-w) a_k + w a_{k+1}
+   * 原地覆盖本表（单组）的系数。系数对纵坐标是线性的，结果等于拟合混合后的纵坐标。
+   */
+  void blendSets(const SplineTable & stages, unsigned int k, Real w);
+
+  /// 选择区间查找方式
+  void setSearch(Search search) { _search = search; }
+  Search search() const { return _search; }
+
+  /// 返回包含c的区间编号（c需已限制在定义域内）
+  unsigned int interval(Real c) const
+  {
+    switch (_search)
+    {
+      case Search::UNIFORM:
+        return uniformInterval(c);
+      case Search::UNROLLED:
+        return unrolledInterval(c);
+      default:
+        return binaryInterval(c);
+    }
+  }
+
+  /// 一次查找计算（第一组）函数值及一、二阶导数
+  void evaluate(Real c, Real & f, Real & df, Real & d2f) const
+  {
+    const unsigned int i = interval(c);
+    const Real * a = &_coef[4 * i * _n_sets];
+    const std::size_t s = _n_sets;
+    const Real t = c - _x[i];
+    f = a[0] + t * (a[s] + t * (a[2 * s] + t * a[3 * s]));
+    df = a[s] + t * (2.0 * a[2 * s] + 3.0 * t * a[3 * s]);
+    d2f = 2.0 * a[2 * s] + 6.0 * t * a[3 * s];
+  }
+
+  Real sample(Real c) const
+  {
+    const unsigned int i = interval(c);
+    const Real * a = &_coef[4 * i * _n_sets];
+    const std::size_t s = _n_sets;
+    const Real t = c - _x[i];
+    return a[0] + t * (a[s] + t * (a[2 * s] + t * a[3 * s]));
+  }
+
+  /// 一次查找计算全部各组的函数值及导数，输出数组长度为numSets()
+  void evaluateSets(Real c, Real * f, Real * df, Real * d2f) const
+  {
+    const unsigned int i = interval(c);
+    const std::size_t s = _n_sets;
+    const Real * a0 = &_coef[4 * i * s];
+    const Real * a1 = a0 + s;
+    const Real * a2 = a1 + s;
+    const Real * a3 = a2 + s;
+    const Real t = c - _x[i];
+    for (std::size_t k = 0; k < s; ++k)
+    {
+      f[k] = a0[k] + t * (a1[k] + t * (a2[k] + t * a3[k]));
+      df[k] = a1[k] + t * (2.0 * a2[k] + 3.0 * t * a3[k]);
+      d2f[k] = 2.0 * a2[k] + 6.0 * t * a3[k];
+    }
+  }
+
+  /// 是否为周期样条
+  bool isPeriodic() const { return _period > 0.0; }
+
+  /// 把c折回周期[x_0, x_0 + 周期]内（周期样条）
+  Real wrap(Real c) const
+  {
+    const Real c0 = c - _period * std::floor((c - _x.front()) / _period);
+    return c0 < _x.back() ? c0 : _x.front();
+  }
+
+  /// 共享节点的样条组数
+  unsigned int numSets() const { return _n_sets; }
+
+  const std::vector<Real> & knots() const { return _x; }
+
+  /// 分段多项式系数，布局见_coef
+  const Storage & coefficients() const { return _coef; }
+  unsigned int numIntervals() const { return _x.empty() ? 0 : _x.size() - 1; }
+
+  /// 节点是否（在舍入误差内）等距
+  bool isUniform() const { return _uniform; }
+
+  /// 表占用的字节数
+  std::size_t memoryBytes() const;
+
+  /// 求解三对角方程组得到节点处的二阶导数
+  static void secondDerivatives(const std::vector<Real> & x,
+                                const std::vector<Real> & y,
+                                Real yp1,
+                                Real ypn,
+                                std::vector<Real> & y2);
+
+  /// 求解循环三对角方程组得到周期样条节点处的二阶导数
+  static void
+  periodicSecondDerivatives(const std::vector<Real> & x, const std::vector<Real> & y, std::vector<Real> & y2);
+
+  /**
+   * 由区间两端的函数值和二阶导数计算多项式系数 a[0], a[stride], a[2 stride], a[3 stride]
+   */
+  static void intervalCoefficients(
+      Real h, Real y0, Real y1, Real y2_0, Real y2_1, Real * a, std::size_t stride = 1)
+  {
+    a[0] = y0;
+    a[stride] = (y1 - y0) / h - h * (2.0 * y2_0 + y2_1) / 6.0;
+    a[2 * stride] = 0.5 * y2_0;
+    a[3 * stride] = (y2_1 - y2_0) / (6.0 * h);
+  }
+
+protected:
+  /// 由_x建立各种区间查找所需的索引
+  void buildSearch();
+
+  unsigned int binaryInterval(Real c) const;
+
+  unsigned int uniformInterval(Real c) const
+  {
+    const Real t = (c - _x.front()) * _inv_bucket_width;
+    std::size_t b = t > 0.0 ? static_cast<std::size_t>(t) : 0;
+    if (b >= _bucket.size())
+      b = _bucket.size() - 1;
+    unsigned int i = _bucket[b];
+    // 非等距网格时一个桶可能跨越多个节点
+    while (i + 2 < _x.size() && c >= _x[i + 1])
+      ++i;
+    while (i > 0 && c < _x[i])
+      --i;
+    return i;
+  }
+
+  unsigned int unrolledInterval(Real c) const
+  {
+    const unsigned int i = _unrolled(_x_padded.data(), c);
+    return i + 2 < _x.size() ? i : _x.size() - 2;
+  }
+
+  /// 节点
+  std::vector<Real> _x;
+
+  /**
+   * 每个区间每组4个系数：f = a0 + a1 t + a2 t^2 + a3 t^3，t = c - x_i。
+   * 布局为 [区间][系数阶次][组]，同一阶次的各组系数连续存放。
+   */
+  Storage _coef;
+
+  /// 样条组数
+  unsigned int _n_sets = 1;
+
+  /// 周期样条的周期（非周期时为0）
+  Real _period = 0.0;
+
+  bool _huge_pages = false;
+
+  Search _search = Search::BINARY;
+
+  bool _uniform = false;
+
+  /// 均匀分桶索引：桶 -> 桶左端所在区间
+  std::vector<unsigned int, SplineTableAllocator<unsigned int>> _bucket;
+  Real _inv_bucket_width = 0.0;
+
+  /// 展开查找用的节点（以+inf补齐到2的幂）
+  Storage _x_padded;
+
+  /// 按查找深度在编译期展开的无分支二分查找
+  typedef unsigned int (*UnrolledSearch)(const Real *, Real);
+  UnrolledSearch _unrolled = nullptr;
+};
@@ -0,0 +1,117 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/**
+ * Allocator for spline table storage. Allocations are cache line aligned, and
+ * when huge pages are requested, allocations of at least 2MB are mapped
+ * directly and backed by huge pages (explicit hugetlb pages if the system has a
+ * pool reserved, transparent huge pages otherwise) to cut TLB misses.
+ */
+template <typename T>
+class SplineTableAllocator
+{
+public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  /// 大页大小
+  static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+  SplineTableAllocator(bool huge_pages = false) noexcept : _huge_pages(huge_pages) {}
+
+  template <typename U>
+  SplineTableAllocator(const SplineTableAllocator<U> & other) noexcept
+    : _huge_pages(other.hugePages())
+  {
+  }
+
+  T * allocate(std::size_t n)
+  {
+    const std::size_t bytes = n * sizeof(T);
+#ifdef __linux__
+    if (useMmap(bytes))
+    {
+      const std::size_t size = mappedSize(bytes);
+      void * p = mmap(nullptr, size, PROT_READ | PROT_WRITE, hugetlb_flags, -1, 0);
+      if (p == MAP_FAILED)
+      {
+        // 没有预留的hugetlb页时退回透明大页
+        p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+          throw std::bad_alloc();
+        madvise(p, size, MADV_HUGEPAGE);
+      }
+      return static_cast<T *>(p);
+    }
+#endif
+    return static_cast<T *>(::operator new(bytes, std::align_val_t(alignment)));
+  }
+
+  void deallocate(T * p, std::size_t n) noexcept
+  {
+    const std::size_t bytes = n * sizeof(T);
+#ifdef __linux__
+    if (useMmap(bytes))
+    {
+      munmap(p, mappedSize(bytes));
+      return;
+    }
+#endif
+    ::operator delete(p, std::align_val_t(alignment));
+  }
+
+  bool hugePages() const { return _huge_pages; }
+
+private:
+  /// 至少按缓存行对齐
+  static constexpr std::size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+
+#ifdef __linux__
+#ifdef MAP_HUGE_2MB
+  static constexpr int hugetlb_flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB;
+#else
+  static constexpr int hugetlb_flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#endif
+#endif
+
+  bool useMmap(std::size_t bytes) const { return _huge_pages && bytes >= huge_page_size; }
+
+  static std::size_t mappedSize(std::size_t bytes)
+  {
+    return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+  }
+
+  bool _huge_pages;
+};
+
+template <typename T, typename U>
+bool
+operator==(const SplineTableAllocator<T> & a, const SplineTableAllocator<U> & b)
+{
+  return a.hugePages() == b.hugePages();
+}
+
+template <typename T, typename U>
+bool
+operator!=(const SplineTableAllocator<T> & a, const SplineTableAllocator<U> & b)
+{
+  return !(a == b);
+}
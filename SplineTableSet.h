@@ -0,0 +1,85 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "SplineTableAllocator.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * A set of independent cubic splines packed into one contiguous knot buffer and
+ * one contiguous coefficient buffer. Each table may have its own knots; a table
+ * is selected by index at evaluation time.
+ */
+class SplineTableSet
+{
+public:
+  SplineTableSet() = default;
+
+  /// 是否为大表使用大页（需在addTable之前设置）
+  void setHugePages(bool huge_pages)
+  {
+    _x = decltype(_x)(SplineTableAllocator<Real>(huge_pages));
+    _coef = decltype(_coef)(SplineTableAllocator<Real>(huge_pages));
+  }
+
+  /**
+   * 添加一张表并返回其编号，yp1/ypn >= 1e30 表示自然边界条件
+   */
+  unsigned int
+  addTable(const std::vector<Real> & x, const std::vector<Real> & y, Real yp1 = 1e30, Real ypn = 1e30);
+
+  unsigned int numTables() const { return _tables.size(); }
+  bool empty() const { return _tables.empty(); }
+
+  /// 第t张表的定义域
+  Real xMin(unsigned int t) const { return _x[_tables[t].knot_offset]; }
+  Real xMax(unsigned int t) const { return _x[_tables[t].knot_offset + _tables[t].size - 1]; }
+
+  /// 用第t张表计算函数值及一、二阶导数（c需已限制在该表定义域内）
+  void evaluate(unsigned int t, Real c, Real & f, Real & df, Real & d2f) const
+  {
+    const Table & table = _tables[t];
+    const Real * x = &_x[table.knot_offset];
+    const std::size_t i = std::upper_bound(x + 1, x + table.size - 1, c) - x - 1;
+    const Real * a = &_coef[table.coef_offset + 4 * i];
+    const Real dx = c - x[i];
+    f = a[0] + dx * (a[1] + dx * (a[2] + dx * a[3]));
+    df = a[1] + dx * (2.0 * a[2] + 3.0 * dx * a[3]);
+    d2f = 2.0 * a[2] + 6.0 * dx * a[3];
+  }
+
+  /// 在调用线程中重新分配并复制全部存储（NUMA first touch）
+  void relocate();
+
+  /// 占用的字节数
+  std::size_t memoryBytes() const;
+
+private:
+  struct Table
+  {
+    /// 第一个节点在_x中的位置
+    std::size_t knot_offset;
+    /// 第一个系数在_coef中的位置
+    std::size_t coef_offset;
+    /// 节点数
+    unsigned int size;
+  };
+
+  std::vector<Table> _tables;
+
+  /// 全部表的节点，依次连续存放
+  std::vector<Real, SplineTableAllocator<Real>> _x;
+
+  /// 全部表的分段多项式系数，每个区间4个
+  std::vector<Real, SplineTableAllocator<Real>> _coef;
+};
@@ -0,0 +1,72 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DerivativeMaterialInterface.h"
+#include "Material.h"
+#include "RankFourTensor.h"
+#include "RankTwoTensor.h"
+#include "SplineTable.h"
+
+/**
+ * Elasticity tensor C_ijkl(c) and eigenstrain eps*(c) interpolated by cubic
+ * splines through tabulated components, with their derivatives with respect
+ * to c. All independent components share one knot grid and are stored
+ * interleaved per interval, so one interval search and one vectorizable sweep
+ * evaluate every component of both tensors.
+ */
+class SplineTensorMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  static InputParameters validParams();
+  SplineTensorMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  // 由分量填充张量（填充方式对分量是线性的，导数可同样填充）
+  void fillElasticity(RankFourTensor & tensor, const Real * components);
+  void fillEigenstrain(RankTwoTensor & tensor, const Real * components);
+
+  // 浓度变量
+  const VariableValue & _c;
+  const VariableName _var_name;
+
+  // 导数阶数
+  const unsigned int _derivative_order;
+
+  // 各分量的样条：弹性张量分量在前，本征应变分量在后
+  SplineTable _table;
+  unsigned int _n_elasticity;
+  unsigned int _n_eigenstrain;
+
+  // 定义域边界
+  Real _x_min;
+  Real _x_max;
+
+  // 弹性张量分量的填充方式
+  const RankFourTensor::FillMethod _fill_method;
+
+  // 材料属性及其对c的导数（未给出对应分量时为nullptr）
+  MaterialProperty<RankFourTensor> * _elasticity;
+  MaterialProperty<RankFourTensor> * _delasticity;
+  MaterialProperty<RankFourTensor> * _d2elasticity;
+  MaterialProperty<RankTwoTensor> * _eigenstrain;
+  MaterialProperty<RankTwoTensor> * _deigenstrain;
+  MaterialProperty<RankTwoTensor> * _d2eigenstrain;
+
+  // 一次求值得到的全部分量及导数
+  std::vector<Real> _values;
+  std::vector<Real> _first;
+  std::vector<Real> _second;
+
+  // 填充张量的暂存数组
+  std::vector<Real> _components;
+};
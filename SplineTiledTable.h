@@ -0,0 +1,204 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Cubic spline table read from a tiled binary file. The file is memory mapped;
+ * the knots are kept in memory for the interval search, while the polynomial
+ * coefficients are split into tiles of a fixed number of intervals that are
+ * paged in on demand and held in a small LRU cache. Each process therefore only
+ * keeps the part of the table its evaluation points actually visit.
+ *
+ * Version 2 files describe the table in the header (dimension, grid type,
+ * interpolant), may store each tile zlib compressed, and carry a CRC32 checksum
+ * of everything following the header. Version 1 files are still read.
+ */
+class SplineTiledTable
+{
+public:
+  SplineTiledTable() = default;
+  ~SplineTiledTable();
+
+  SplineTiledTable(const SplineTiledTable &) = delete;
+  SplineTiledTable & operator=(const SplineTiledTable &) = delete;
+
+  /// 网格类型
+  enum class Grid : std::uint32_t
+  {
+    NONUNIFORM = 0,
+    UNIFORM = 1
+  };
+
+  /// 插值类型
+  enum class Interpolant : std::uint32_t
+  {
+    CUBIC_SPLINE = 1
+  };
+
+  /// 块的压缩方式
+  enum class Compression : std::uint32_t
+  {
+    NONE = 0,
+    ZLIB = 1
+  };
+
+  /**
+   * 将x/y样条写成分块表文件，每块包含tile_intervals个区间
+   */
+  static void write(const std::string & file_name,
+                    const std::vector<Real> & x,
+                    const std::vector<Real> & y,
+                    Real yp1,
+                    Real ypn,
+                    unsigned int tile_intervals,
+                    Compression compression = Compression::NONE);
+
+  /**
+   * 映射表文件并读入节点，缓存最多cache_tiles个解码后的块；
+   * verify_checksum时先校验文件头之后全部内容的CRC32（需读入整个文件）
+   */
+  void open(const std::string & file_name, unsigned int cache_tiles, bool verify_checksum = false);
+
+  /// 文件头中记录的网格类型和压缩方式
+  Grid grid() const { return _grid; }
+  Compression compression() const { return _compression; }
+
+  bool empty() const { return _x.empty(); }
+
+  const std::vector<Real> & knots() const { return _x; }
+
+  /// 计算函数值及一、二阶导数（c需已限制在定义域内）
+  void evaluate(Real c, Real & f, Real & df, Real & d2f) const
+  {
+    const std::size_t i = interval(c);
+    const std::size_t tile = i / _tile_intervals;
+    const Real * a = tileData(tile) + 4 * (i - tile * _tile_intervals);
+    const Real t = c - _x[i];
+    f = a[0] + t * (a[1] + t * (a[2] + t * a[3]));
+    df = a[1] + t * (2.0 * a[2] + 3.0 * t * a[3]);
+    d2f = 2.0 * a[2] + 6.0 * t * a[3];
+  }
+
+  /// 最后一个 x_i <= c 的区间
+  std::size_t interval(Real c) const
+  {
+    return std::upper_bound(_x.begin() + 1, _x.end() - 1, c) - _x.begin() - 1;
+  }
+
+  /**
+   * 取出区间[first, last]的节点和系数（未压缩时直接读映射文件，不经过缓存）
+   */
+  void extract(std::size_t first,
+               std::size_t last,
+               std::vector<Real> & x,
+               std::vector<Real> & coef) const;
+
+  /// 清空块缓存
+  void dropCache();
+
+  /// 常驻内存的字节数（节点与缓存的块）
+  std::size_t residentBytes() const;
+
+  /// 块缓存命中/未命中次数
+  std::uint64_t cacheHits() const { return _hits; }
+  std::uint64_t cacheMisses() const { return _misses; }
+
+protected:
+  /// 文件头；第1版只有到coef_offset为止的部分
+  struct Header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t real_size;
+    std::uint64_t n_knots;
+    std::uint64_t tile_intervals;
+    std::uint64_t knots_offset;
+    std::uint64_t coef_offset;
+    // 第2版
+    std::uint32_t dimension;
+    std::uint32_t grid;
+    std::uint32_t interpolant;
+    std::uint32_t compression;
+    std::uint64_t tile_index_offset;
+    std::uint32_t checksum;
+    std::uint32_t reserved;
+  };
+
+  /// 压缩块在文件中的位置
+  struct TileEntry
+  {
+    std::uint64_t offset;
+    std::uint64_t bytes;
+  };
+
+  /// 返回第tile块的系数，必要时从映射文件换入
+  const Real * tileData(std::size_t tile) const
+  {
+    if (tile != _last_tile)
+    {
+      int slot = _slot_of_tile[tile];
+      if (slot < 0)
+        slot = loadTile(tile);
+      else
+        ++_hits;
+      _slots[slot].last_use = ++_clock;
+      _last_tile = tile;
+      _last_data = _slots[slot].data.data();
+    }
+    else
+      ++_hits;
+    return _last_data;
+  }
+
+  /// 换入一块（替换最久未使用的槽）并返回槽编号
+  int loadTile(std::size_t tile) const;
+
+  void close();
+
+  /// 常驻的节点
+  std::vector<Real> _x;
+
+  std::size_t _tile_intervals = 0;
+  std::size_t _n_tiles = 0;
+
+  /// 文件映射
+  void * _map = nullptr;
+  std::size_t _map_size = 0;
+  const Real * _mapped_coef = nullptr;
+
+  /// 压缩块的索引（指向映射文件）
+  const TileEntry * _tile_index = nullptr;
+  Grid _grid = Grid::NONUNIFORM;
+  Compression _compression = Compression::NONE;
+
+  /// LRU缓存
+  struct Slot
+  {
+    std::size_t tile;
+    std::uint64_t last_use;
+    std::vector<Real> data;
+  };
+  mutable std::vector<Slot> _slots;
+  mutable std::vector<int> _slot_of_tile;
+  mutable std::uint64_t _clock = 0;
+  mutable std::size_t _last_tile = static_cast<std::size_t>(-1);
+  mutable const Real * _last_data = nullptr;
+  unsigned int _cache_tiles = 0;
+
+  mutable std::uint64_t _hits = 0;
+  mutable std::uint64_t _misses = 0;
+};
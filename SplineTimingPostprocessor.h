@@ -0,0 +1,54 @@
+//* This file is part of the MOOSE framework
+//* https://mooseframework.inl.gov
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class SplineParsedMaterial;
+
+/**
+ * Reports the time a SplineParsedMaterial with collect_timing = true has
+ * spent in computeProperties since the start of the run: the largest time of
+ * any thread on any process (the material's share of the critical path), the
+ * sum over all threads and processes, the number of evaluated quadrature
+ * points, or the total time per quadrature point.
+ */
+class SplineTimingPostprocessor : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+  SplineTimingPostprocessor(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override { return _value; }
+
+protected:
+  /// 输出的量
+  enum class Quantity
+  {
+    MAX_TIME,
+    TOTAL_TIME,
+    POINTS,
+    TIME_PER_POINT
+  };
+
+  const Quantity _quantity;
+
+  // 各线程的材料对象
+  std::vector<const SplineParsedMaterial *> _materials;
+
+  Real _value;
+
+  // time_per_point 的分母
+  Real _points;
+};
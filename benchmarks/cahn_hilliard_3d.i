@@ -0,0 +1,124 @@
+# 三维Cahn-Hilliard扩展性测试：自由能由SplineParsedMaterial给出
+# 网格尺寸和步数可在命令行覆盖，例如 nz=80 steps=5（见 scaling_study.py）
+
+nx = 20
+ny = 20
+nz = 20
+steps = 5
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = ${nx}
+    ny = ${ny}
+    nz = ${nz}
+    xmax = ${nx}
+    ymax = ${ny}
+    zmax = ${nz}
+    elem_type = HEX8
+  []
+  parallel_type = replicated
+[]
+
+[Variables]
+  [c]
+    [InitialCondition]
+      type = RandomIC
+      min = 0.45
+      max = 0.55
+      seed = 12345
+    []
+  []
+  [w]
+  []
+[]
+
+[Kernels]
+  [c_res]
+    type = SplitCHParsed
+    variable = c
+    f_name = F
+    kappa_name = kappa
+    w = w
+  []
+  [w_res]
+    type = SplitCHWRes
+    variable = w
+    mobility = M
+  []
+  [time]
+    type = CoupledTimeDerivative
+    variable = w
+    v = c
+  []
+[]
+
+[Materials]
+  [constants]
+    type = GenericConstantMaterial
+    prop_names = 'M kappa'
+    prop_values = '1.0 0.5'
+  []
+  [free_energy]
+    type = SplineParsedMaterial
+    # f = c^2 (1-c)^2
+    x = '0 0.05 0.1 0.15 0.2 0.25 0.3 0.35 0.4 0.45 0.5 0.55 0.6 0.65 0.7 0.75 0.8 0.85 0.9 0.95 1'
+    y = '0 0.00225625 0.0081 0.01625625 0.0256 0.03515625 0.0441 0.05175625 0.0576 0.06125625 0.0625 0.06125625 0.0576 0.05175625 0.0441 0.03515625 0.0256 0.01625625 0.0081 0.00225625 0'
+    spline_variable = c
+    coupled_variables = 'c'
+    property_name = F
+    derivative_order = 2
+    collect_timing = true
+  []
+[]
+
+[Postprocessors]
+  [material_time]
+    type = SplineTimingPostprocessor
+    material = free_energy
+    quantity = max_time
+  []
+  [material_time_total]
+    type = SplineTimingPostprocessor
+    material = free_energy
+    quantity = total_time
+  []
+  [time_per_point]
+    type = SplineTimingPostprocessor
+    material = free_energy
+    quantity = time_per_point
+  []
+  [run_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  []
+  [elements]
+    type = NumElements
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -sub_pc_type'
+  petsc_options_value = 'bjacobi ilu'
+  l_max_its = 30
+  nl_max_its = 10
+  nl_rel_tol = 1e-8
+  dt = 0.1
+  num_steps = ${steps}
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
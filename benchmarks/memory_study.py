@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Memory-footprint study for SplineParsedMaterial.
+
+Generates a small 3D Cahn-Hilliard input for each configuration and varies,
+one at a time from the smallest case, the number of spline knots, the number
+of SplineParsedMaterial instances (each with its own table and properties)
+and the thread count. For every run it reports the peak resident set size of
+the largest process (MemoryUsage) next to the memory the material itself
+accounts for (SplineMemoryPostprocessor, summed over the block, face and
+neighbor copies on every thread), so the effect of deduplicating or
+compressing tables can be quantified.
+
+    memory_study.py --app ../test-opt
+    memory_study.py --app ../test-opt --knots 1000 100000 1000000 --instances 1 8 --threads 1 4
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+
+INPUT = """
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = {n}
+    ny = {n}
+    nz = {n}
+  []
+[]
+
+[Variables]
+  [c]
+    [InitialCondition]
+      type = RandomIC
+      min = 0.45
+      max = 0.55
+    []
+  []
+  [w]
+  []
+[]
+
+[Kernels]
+  [c_res]
+    type = SplitCHParsed
+    variable = c
+    f_name = F0
+    kappa_name = kappa
+    w = w
+  []
+  [w_res]
+    type = SplitCHWRes
+    variable = w
+    mobility = M
+  []
+  [time]
+    type = CoupledTimeDerivative
+    variable = w
+    v = c
+  []
+[]
+
+[Materials]
+  [constants]
+    type = GenericConstantMaterial
+    prop_names = 'M kappa'
+    prop_values = '1.0 0.5'
+  []
+{materials}[]
+
+[Postprocessors]
+  [peak_rss]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+    mem_units = bytes
+  []
+  [table_bytes]
+    type = SplineMemoryPostprocessor
+    material = free_energy_0
+    quantity = table_bytes
+    value_type = max_process
+  []
+  [property_bytes]
+    type = SplineMemoryPostprocessor
+    material = free_energy_0
+    quantity = property_bytes
+    value_type = max_process
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 0.1
+  num_steps = {steps}
+[]
+
+[Outputs]
+  csv = true
+[]
+"""
+
+MATERIAL = """  [free_energy_{k}]
+    type = SplineParsedMaterial
+    x = '{x}'
+    y = '{y}'
+    spline_variable = c
+    coupled_variables = 'c'
+    property_name = F{k}
+    derivative_order = 2
+  []
+"""
+
+
+# MOOSE在每个线程上为每个材料构造体积、面和相邻单元三份副本
+COPIES_PER_THREAD = 3
+
+
+def write_input(path, knots, instances, args):
+    """Double-well f = c^2 (1-c)^2 tabulated on the given number of knots."""
+    x = [i / (knots - 1) for i in range(knots)]
+    x_text = " ".join("{:.12g}".format(v) for v in x)
+    y_text = " ".join("{:.12g}".format(v * v * (1 - v) * (1 - v)) for v in x)
+    materials = "".join(MATERIAL.format(k=k, x=x_text, y=y_text) for k in range(instances))
+    with open(path, "w") as f:
+        f.write(INPUT.format(n=args.elements, steps=args.steps, materials=materials))
+
+
+def run(args, knots, instances, threads):
+    """Run one configuration and return the last row of its CSV output."""
+    file_base = "memory_k{}_i{}_t{}".format(knots, instances, threads)
+    input_file = os.path.join(args.workdir, file_base + ".i")
+    write_input(input_file, knots, instances, args)
+    command = [
+        args.app,
+        "-i",
+        os.path.abspath(input_file),
+        "--n-threads={}".format(threads),
+        "Outputs/file_base={}".format(file_base),
+    ]
+
+    print("running:", " ".join(command), flush=True)
+    with open(os.path.join(args.workdir, file_base + ".log"), "w") as log:
+        subprocess.run(command, cwd=args.workdir, stdout=log, stderr=subprocess.STDOUT, check=True)
+
+    with open(os.path.join(args.workdir, file_base + ".csv"), newline="") as f:
+        rows = list(csv.DictReader(f))
+    row = {key: float(value) for key, value in rows[-1].items()}
+    row.update(knots=knots, instances=instances, threads=threads)
+    return row
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--app", required=True, help="MOOSE application executable")
+    parser.add_argument("--knots", type=int, nargs="+", default=[100, 1000, 10000, 100000], help="spline knot counts")
+    parser.add_argument("--instances", type=int, nargs="+", default=[1, 4, 16], help="numbers of material instances")
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4], help="thread counts")
+    parser.add_argument("--elements", type=int, default=10, help="elements per direction")
+    parser.add_argument("--steps", type=int, default=1, help="time steps per run")
+    parser.add_argument("--workdir", default=".", help="directory for generated inputs, logs and CSV output")
+    parser.add_argument("--csv", help="also write the summary table to this CSV file")
+    args = parser.parse_args()
+    os.makedirs(args.workdir, exist_ok=True)
+
+    # 从最小的配置出发，每次只改变一个因素
+    knots, instances, threads = min(args.knots), min(args.instances), min(args.threads)
+    configurations = [("knots", k, instances, threads) for k in sorted(args.knots)]
+    configurations += [("instances", knots, i, threads) for i in sorted(args.instances) if i != instances]
+    configurations += [("threads", knots, instances, t) for t in sorted(args.threads) if t != threads]
+
+    summary = []
+    baseline = None
+    for sweep, k, i, t in configurations:
+        row = run(args, k, i, t)
+        if baseline is None:
+            baseline = row["peak_rss"]
+        # 后处理器已对0号实例在各线程上的体积、面和相邻单元副本求和，其余实例相同
+        accounted = (row["table_bytes"] + row["property_bytes"]) * i
+        copies = COPIES_PER_THREAD * t
+        summary.append(
+            {
+                "sweep": sweep,
+                "knots": k,
+                "instances": i,
+                "threads": t,
+                "peak_rss_mb": row["peak_rss"] / 2**20,
+                "rss_increase_mb": (row["peak_rss"] - baseline) / 2**20,
+                "material_mb": accounted / 2**20,
+                "table_bytes_per_copy": row["table_bytes"] / copies,
+                "property_bytes_per_copy": row["property_bytes"] / copies,
+            }
+        )
+
+    print()
+    print("{:>9} {:>8} {:>9} {:>7} {:>12} {:>12} {:>12} {:>14} {:>14}".format(
+        "sweep", "knots", "instances", "threads", "peak RSS[MB]", "increase[MB]", "material[MB]",
+        "table[B]/copy", "props[B]/copy"))
+    for r in summary:
+        print("{:>9} {:>8} {:>9} {:>7} {:>12.1f} {:>12.1f} {:>12.2f} {:>14.0f} {:>14.0f}".format(
+            r["sweep"], r["knots"], r["instances"], r["threads"], r["peak_rss_mb"], r["rss_increase_mb"],
+            r["material_mb"], r["table_bytes_per_copy"], r["property_bytes_per_copy"]))
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=list(summary[0].keys()))
+            writer.writeheader()
+            writer.writerows(summary)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
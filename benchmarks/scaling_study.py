@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Thread and MPI scaling study for SplineParsedMaterial on one node.
+
+Runs cahn_hilliard_3d.i over 1..N threads (one rank) and 1..N ranks (one
+thread each). In weak mode (default) every core gets base^3 elements, the mesh
+growing along z; in strong mode the mesh is fixed at base^3. The material time
+is the largest per-thread time reported by SplineTimingPostprocessor, so it
+isolates contention in the material from solver and assembly scaling, which
+is shown next to it as the total run time.
+
+    scaling_study.py --app ../test-opt --max-threads 16 --max-ranks 16
+    scaling_study.py --app ../test-opt --max-threads 8 --min-efficiency 0.8
+
+With --min-efficiency the script exits nonzero when any material efficiency
+drops below the limit, so it can guard against contention regressions.
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+
+
+def counts(maximum):
+    """1, 2, 4, ... up to and including maximum."""
+    values = []
+    n = 1
+    while n < maximum:
+        values.append(n)
+        n *= 2
+    values.append(maximum)
+    return values
+
+
+def run(args, ranks, threads):
+    """Run one configuration and return the last row of its CSV output."""
+    cores = ranks * threads
+    nz = args.base * cores if args.mode == "weak" else args.base
+    file_base = "scaling_{}_r{}_t{}".format(args.mode, ranks, threads)
+    command = [
+        args.app,
+        "-i",
+        os.path.abspath(args.input),
+        "--n-threads={}".format(threads),
+        "nx={}".format(args.base),
+        "ny={}".format(args.base),
+        "nz={}".format(nz),
+        "steps={}".format(args.steps),
+        "Outputs/file_base={}".format(file_base),
+    ]
+    if ranks > 1:
+        command = [args.mpiexec, "-n", str(ranks)] + command
+
+    print("running:", " ".join(command), flush=True)
+    with open(os.path.join(args.workdir, file_base + ".log"), "w") as log:
+        subprocess.run(command, cwd=args.workdir, stdout=log, stderr=subprocess.STDOUT, check=True)
+
+    with open(os.path.join(args.workdir, file_base + ".csv"), newline="") as f:
+        rows = list(csv.DictReader(f))
+    row = {key: float(value) for key, value in rows[-1].items()}
+    row["ranks"] = ranks
+    row["threads"] = threads
+    row["cores"] = cores
+    return row
+
+
+def speedup_and_efficiency(mode, reference, value, cores):
+    """Weak scaling: ideal times are constant; strong scaling: ideal times fall as 1/cores."""
+    if value <= 0.0:
+        return float("nan"), float("nan")
+    if mode == "weak":
+        efficiency = reference / value
+        return cores * efficiency, efficiency
+    speedup = reference / value
+    return speedup, speedup / cores
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--app", required=True, help="MOOSE application executable")
+    parser.add_argument(
+        "--input",
+        default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "cahn_hilliard_3d.i"),
+        help="benchmark input file",
+    )
+    parser.add_argument("--max-threads", type=int, default=os.cpu_count(), help="largest thread count")
+    parser.add_argument("--max-ranks", type=int, default=os.cpu_count(), help="largest MPI rank count")
+    parser.add_argument("--base", type=int, default=20, help="elements per direction per core (weak) or in total (strong)")
+    parser.add_argument("--steps", type=int, default=5, help="time steps per run")
+    parser.add_argument("--mode", choices=["weak", "strong"], default="weak")
+    parser.add_argument("--mpiexec", default="mpiexec", help="MPI launcher")
+    parser.add_argument("--workdir", default=".", help="directory for logs and CSV output")
+    parser.add_argument("--csv", help="also write the summary table to this CSV file")
+    parser.add_argument(
+        "--min-efficiency",
+        type=float,
+        default=0.0,
+        help="exit with status 1 if any material efficiency is below this value",
+    )
+    args = parser.parse_args()
+    os.makedirs(args.workdir, exist_ok=True)
+
+    # 线程扩展（单进程）与进程扩展（单线程），都以1核的结果为基准
+    sweeps = [("threads", [(1, t) for t in counts(args.max_threads)])]
+    if args.max_ranks > 1:
+        sweeps.append(("ranks", [(r, 1) for r in counts(args.max_ranks)]))
+
+    reference = run(args, 1, 1)
+    summary = []
+    for sweep, configurations in sweeps:
+        for ranks, threads in configurations:
+            row = reference if ranks * threads == 1 else run(args, ranks, threads)
+            material = speedup_and_efficiency(
+                args.mode, reference["material_time"], row["material_time"], row["cores"]
+            )
+            total = speedup_and_efficiency(args.mode, reference["run_time"], row["run_time"], row["cores"])
+            summary.append(
+                {
+                    "sweep": sweep,
+                    "ranks": ranks,
+                    "threads": threads,
+                    "elements": int(row["elements"]),
+                    "material_time": row["material_time"],
+                    "material_speedup": material[0],
+                    "material_efficiency": material[1],
+                    "ns_per_point": row["time_per_point"] * 1e9,
+                    "run_time": row["run_time"],
+                    "run_speedup": total[0],
+                    "run_efficiency": total[1],
+                }
+            )
+
+    header = "{:>7} {:>5} {:>7} {:>9} {:>12} {:>8} {:>6} {:>9} {:>10} {:>8} {:>6}".format(
+        "sweep", "ranks", "threads", "elements", "material[s]", "speedup", "eff", "ns/point", "run[s]", "speedup", "eff"
+    )
+    print()
+    print("{} scaling, material time = slowest thread".format(args.mode))
+    print(header)
+    for r in summary:
+        print(
+            "{:>7} {:>5} {:>7} {:>9} {:>12.4f} {:>8.2f} {:>6.2f} {:>9.1f} {:>10.2f} {:>8.2f} {:>6.2f}".format(
+                r["sweep"],
+                r["ranks"],
+                r["threads"],
+                r["elements"],
+                r["material_time"],
+                r["material_speedup"],
+                r["material_efficiency"],
+                r["ns_per_point"],
+                r["run_time"],
+                r["run_speedup"],
+                r["run_efficiency"],
+            )
+        )
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=list(summary[0].keys()))
+            writer.writeheader()
+            writer.writerows(summary)
+
+    worst = min(summary, key=lambda r: r["material_efficiency"])
+    if worst["material_efficiency"] < args.min_efficiency:
+        print(
+            "material efficiency {:.2f} at {} ranks x {} threads is below {:.2f}".format(
+                worst["material_efficiency"], worst["ranks"], worst["threads"], args.min_efficiency
+            ),
+            file=sys.stderr,
+        )
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Convert an x,y CSV file into the tiled binary spline table read by
+SplineParsedMaterial (table_file).
+
+The cubic spline is fitted exactly as SplineTable::setData does (natural end
+conditions unless --yp1/--ypn are given) and written in format version 2:
+header, knots, and per-interval polynomial coefficients, optionally zlib
+compressed per tile, with a CRC32 checksum of everything after the header.
+
+    csv_to_spline_table.py free_energy.csv free_energy.spl --compress
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+import tempfile
+import zlib
+
+MAGIC = b"SPLTILE\0"
+VERSION = 2
+# magic, version, real_size, n_knots, tile_intervals, knots_offset, coef_offset,
+# dimension, grid, interpolant, compression, tile_index_offset, checksum, reserved
+HEADER = struct.Struct("<8sIIQQQQIIIIQII")
+GRID_NONUNIFORM, GRID_UNIFORM = 0, 1
+INTERPOLANT_CUBIC_SPLINE = 1
+COMPRESSION_NONE, COMPRESSION_ZLIB = 0, 1
+
+
+def read_csv(file_name, x_column, y_column):
+    """Read two numeric columns, skipping a header line and '#' comments."""
+    x, y = [], []
+    with open(file_name, newline="") as f:
+        for row in csv.reader(f):
+            if not row or row[0].lstrip().startswith("#"):
+                continue
+            try:
+                x.append(float(row[x_column]))
+                y.append(float(row[y_column]))
+            except ValueError:
+                if x:
+                    raise
+    return x, y
+
+
+def second_derivatives(x, y, yp1, ypn):
+    """Knot second derivatives, same boundary handling as SplineTable."""
+    n = len(x)
+    y2 = [0.0] * n
+    u = [0.0] * n
+    if yp1 is not None:
+        y2[0] = -0.5
+        u[0] = (3.0 / (x[1] - x[0])) * ((y[1] - y[0]) / (x[1] - x[0]) - yp1)
+    for i in range(1, n - 1):
+        sig = (x[i] - x[i - 1]) / (x[i + 1] - x[i - 1])
+        p = sig * y2[i - 1] + 2.0
+        y2[i] = (sig - 1.0) / p
+        u[i] = (y[i + 1] - y[i]) / (x[i + 1] - x[i]) - (y[i] - y[i - 1]) / (x[i] - x[i - 1])
+        u[i] = (6.0 * u[i] / (x[i + 1] - x[i - 1]) - sig * u[i - 1]) / p
+    qn = un = 0.0
+    if ypn is not None:
+        qn = 0.5
+        un = (3.0 / (x[n - 1] - x[n - 2])) * (ypn - (y[n - 1] - y[n - 2]) / (x[n - 1] - x[n - 2]))
+    y2[n - 1] = (un - qn * u[n - 2]) / (qn * y2[n - 2] + 1.0)
+    for k in range(n - 2, -1, -1):
+        y2[k] = y2[k] * y2[k + 1] + u[k]
+    return y2
+
+
+def coefficients(x, y, y2):
+    """Per-interval coefficients a0..a3 of f = a0 + a1 t + a2 t^2 + a3 t^3, t = c - x_i."""
+    coef = []
+    for i in range(len(x) - 1):
+        h = x[i + 1] - x[i]
+        coef += [y[i],
+                 (y[i + 1] - y[i]) / h - h * (2.0 * y2[i] + y2[i + 1]) / 6.0,
+                 0.5 * y2[i],
+                 (y2[i + 1] - y2[i]) / (6.0 * h)]
+    return coef
+
+
+def is_uniform(x):
+    h0 = (x[-1] - x[0]) / (len(x) - 1)
+    return all(abs(x[i + 1] - x[i] - h0) <= 1e-10 * h0 for i in range(len(x) - 1))
+
+
+def write_table(file_name, x, coef, tile_intervals, compress):
+    n_intervals = len(x) - 1
+    n_tiles = (n_intervals + tile_intervals - 1) // tile_intervals
+    knots_offset = HEADER.size
+    payload = struct.pack("<%dd" % len(x), *x)
+
+    tile_index_offset = 0
+    if not compress:
+        coef_offset = knots_offset + len(payload)
+        payload += struct.pack("<%dd" % len(coef), *coef)
+    else:
+        # 逐块压缩，读取时按需解压单个块
+        tile_index_offset = knots_offset + len(payload)
+        coef_offset = tile_index_offset + 16 * n_tiles
+        index, tiles = b"", b""
+        for tile in range(n_tiles):
+            first = tile * tile_intervals
+            count = min(tile_intervals, n_intervals - first)
+            data = zlib.compress(struct.pack("<%dd" % (4 * count),
+                                             *coef[4 * first:4 * (first + count)]), 9)
+            index += struct.pack("<QQ", coef_offset + len(tiles), len(data))
+            tiles += data
+        payload += index + tiles
+
+    header = HEADER.pack(MAGIC, VERSION, 8, len(x), tile_intervals, knots_offset, coef_offset,
+                         1, GRID_UNIFORM if is_uniform(x) else GRID_NONUNIFORM,
+                         INTERPOLANT_CUBIC_SPLINE,
+                         COMPRESSION_ZLIB if compress else COMPRESSION_NONE,
+                         tile_index_offset, zlib.crc32(payload) & 0xFFFFFFFF, 0)
+    # 先写到同目录下的临时文件再原子地替换，中断时不会留下写了一半的表
+    directory = os.path.dirname(os.path.abspath(file_name))
+    fd, temporary = tempfile.mkstemp(dir=directory, prefix=os.path.basename(file_name) + ".tmp.")
+    try:
+        with os.fdopen(fd, "wb") as f:
+            f.write(header)
+            f.write(payload)
+            f.flush()
+            os.fsync(f.fileno())
+        # mkstemp只给属主读写权限，改为与直接open相同的按umask的权限
+        umask = os.umask(0)
+        os.umask(umask)
+        os.chmod(temporary, 0o666 & ~umask)
+        os.replace(temporary, file_name)
+    except BaseException:
+        os.remove(temporary)
+        raise
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("csv", help="input CSV with x and y columns")
+    parser.add_argument("output", help="binary table file to write")
+    parser.add_argument("--x-column", type=int, default=0, help="column holding x (default 0)")
+    parser.add_argument("--y-column", type=int, default=1, help="column holding y (default 1)")
+    parser.add_argument("--yp1", type=float, help="first derivative at the left end (natural if omitted)")
+    parser.add_argument("--ypn", type=float, help="first derivative at the right end (natural if omitted)")
+    parser.add_argument("--tile-intervals", type=int, default=256,
+                        help="spline intervals per tile (default 256)")
+    parser.add_argument("--compress", action="store_true", help="zlib compress each tile")
+    args = parser.parse_args()
+
+    x, y = read_csv(args.csv, args.x_column, args.y_column)
+    if len(x) < 2:
+        sys.exit("at least two data points are required")
+    if any(x[i + 1] <= x[i] for i in range(len(x) - 1)):
+        sys.exit("x values must be strictly increasing")
+    if args.tile_intervals < 1:
+        sys.exit("tiles need at least one interval")
+
+    coef = coefficients(x, y, second_derivatives(x, y, args.yp1, args.ypn))
+    write_table(args.output, x, coef, args.tile_intervals, args.compress)
+
+
+if __name__ == "__main__":
+    main()
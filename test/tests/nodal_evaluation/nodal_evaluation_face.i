@@ -0,0 +1,92 @@
+# 节点求值的材料在边界上必须与逐积分点求值一致：
+# 面积分点上不能用体积形函数插值节点值，而应逐积分点求值
+# top边界上c沿x线性变化，f非线性，节点插值与逐点求值的结果不同
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 4
+  []
+[]
+
+[Variables]
+  [c]
+  []
+[]
+
+[Kernels]
+  [diffusion]
+    type = Diffusion
+    variable = c
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = c
+    boundary = left
+    value = 0.1
+  []
+  [right]
+    type = DirichletBC
+    variable = c
+    boundary = right
+    value = 0.9
+  []
+[]
+
+[Materials]
+  # f = c^2 (1-c)^2
+  [nodal]
+    type = SplineParsedMaterial
+    x = '0 0.1 0.2 0.3 0.4 0.5 0.6 0.7 0.8 0.9 1'
+    y = '0 0.0081 0.0256 0.0441 0.0576 0.0625 0.0576 0.0441 0.0256 0.0081 0'
+    spline_variable = c
+    coupled_variables = 'c'
+    property_name = F_nodal
+    nodal_evaluation = true
+  []
+  [pointwise]
+    type = SplineParsedMaterial
+    x = '0 0.1 0.2 0.3 0.4 0.5 0.6 0.7 0.8 0.9 1'
+    y = '0 0.0081 0.0256 0.0441 0.0576 0.0625 0.0576 0.0441 0.0256 0.0081 0'
+    spline_variable = c
+    coupled_variables = 'c'
+    property_name = F_pointwise
+  []
+[]
+
+[Postprocessors]
+  [F_nodal_top]
+    type = SideAverageMaterialProperty
+    property = F_nodal
+    boundary = top
+  []
+  [F_pointwise_top]
+    type = SideAverageMaterialProperty
+    property = F_pointwise
+    boundary = top
+  []
+  [difference]
+    type = DifferencePostprocessor
+    value1 = F_nodal_top
+    value2 = F_pointwise_top
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'abs(difference) > 1e-12'
+    error_level = ERROR
+    message = 'nodal_evaluation gives a different free energy on the boundary'
+    execute_on = TIMESTEP_END
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]